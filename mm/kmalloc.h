@@ -0,0 +1,20 @@
+/*
+ * Atlas Kernel - ShadowOS
+ *
+ * License: Apache 2.0
+ * Author: Kevin Alavik <kevin@alavik.se>
+ * Date: October 18, 2026
+ */
+
+#ifndef KMALLOC_H
+#define KMALLOC_H
+
+#include <stddef.h>
+
+// Implemented in mm/kmalloc.d, up to 16 KiB comes from slabs and the rest from VMA page blocks
+extern void *kmalloc(size_t);
+extern void *krealloc(void *, size_t);
+extern void *kcalloc(size_t, size_t);
+extern void kfree(void *);
+
+#endif // KMALLOC_H
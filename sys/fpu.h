@@ -0,0 +1,20 @@
+/*
+ * Atlas Kernel - ShadowOS
+ *
+ * License: Apache 2.0
+ * Author: Kevin Alavik <kevin@alavik.se>
+ * Date: October 18, 2026
+ */
+
+#ifndef FPU_H
+#define FPU_H
+
+#include <stdbool.h>
+
+// Implemented in sys/fpu.d. Vector code in *_sse2.c and *_avx2.c units must run between
+// these two calls, interrupts are off in between so keep the sections short.
+extern void kernelFpuBegin(void);
+extern void kernelFpuEnd(void);
+extern bool kernelFpuHasAvx2(void);
+
+#endif // FPU_H
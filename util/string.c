@@ -8,18 +8,61 @@
 
 #include <stdint.h>
 #include <stddef.h>
-#include <mm/liballoc.h>
+#include <mm/kmalloc.h>
+#include <util/string.h>
 
+/* Defines */
+#define STRING_ONES 0x0101010101010101ull
+#define STRING_HIGHS 0x8080808080808080ull
+#define STRING_HAS_ZERO(v) (((v) - STRING_ONES) & ~(v) & STRING_HIGHS)
+
+#define CPUID_7_EBX_ERMS (1u << 9)
+#define CPUID_7_EDX_FSRM (1u << 4)
+
+// Word sized accesses that may be unaligned and alias anything
+typedef uint64_t __attribute__((may_alias, aligned(1))) string_word_t;
+
+/* Globals */
+// Sizes from which rep movsb/stosb beat the word loops, left at SIZE_MAX without ERMS
+static size_t string_rep_min = SIZE_MAX;
+
+void string_init(void)
+{
+    uint32_t eax, ebx, ecx, edx;
+    __asm__ volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(0), "c"(0));
+    if (eax < 7)
+        return;
+
+    __asm__ volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(7), "c"(0));
+    if (edx & CPUID_7_EDX_FSRM)
+        string_rep_min = 64; // Fast short rep movsb, only tiny copies stay on the word loop
+    else if (ebx & CPUID_7_EBX_ERMS)
+        string_rep_min = 512;
+}
+
+/* Memory */
 void *memcpy(void *dest, const void *src, size_t n)
 {
     uint8_t *pdest = (uint8_t *)dest;
     const uint8_t *psrc = (const uint8_t *)src;
 
-    for (size_t i = 0; i < n; i++)
+    if (n >= string_rep_min)
     {
-        pdest[i] = psrc[i];
+        __asm__ volatile("rep movsb" : "+D"(pdest), "+S"(psrc), "+c"(n) : : "memory");
+        return dest;
     }
 
+    while (n >= 8)
+    {
+        *(string_word_t *)pdest = *(const string_word_t *)psrc;
+        pdest += 8;
+        psrc += 8;
+        n -= 8;
+    }
+
+    while (n--)
+        *pdest++ = *psrc++;
+
     return dest;
 }
 
@@ -27,11 +70,40 @@ void *memset(void *s, int c, size_t n)
 {
     uint8_t *p = (uint8_t *)s;
 
-    for (size_t i = 0; i < n; i++)
+    if (n >= string_rep_min)
     {
-        p[i] = (uint8_t)c;
+        __asm__ volatile("rep stosb" : "+D"(p), "+c"(n) : "a"(c) : "memory");
+        return s;
     }
 
+    uint64_t pattern = (uint8_t)c * STRING_ONES;
+    while (n >= 8)
+    {
+        *(string_word_t *)p = pattern;
+        p += 8;
+        n -= 8;
+    }
+
+    while (n--)
+        *p++ = (uint8_t)c;
+
+    return s;
+}
+
+// Zeroes with non-temporal stores so bulk page clearing doesn't evict the cache, n must be a multiple of 32
+void *memzero_nt(void *s, size_t n)
+{
+    uint64_t *p = (uint64_t *)s;
+
+    for (size_t i = 0; i < n / sizeof(uint64_t); i += 4)
+    {
+        __asm__ volatile("movnti %1, %0" : "=m"(p[i]) : "r"((uint64_t)0));
+        __asm__ volatile("movnti %1, %0" : "=m"(p[i + 1]) : "r"((uint64_t)0));
+        __asm__ volatile("movnti %1, %0" : "=m"(p[i + 2]) : "r"((uint64_t)0));
+        __asm__ volatile("movnti %1, %0" : "=m"(p[i + 3]) : "r"((uint64_t)0));
+    }
+
+    __asm__ volatile("sfence" ::: "memory");
     return s;
 }
 
@@ -40,21 +112,23 @@ void *memmove(void *dest, const void *src, size_t n)
     uint8_t *pdest = (uint8_t *)dest;
     const uint8_t *psrc = (const uint8_t *)src;
 
-    if (src > dest)
-    {
-        for (size_t i = 0; i < n; i++)
-        {
-            pdest[i] = psrc[i];
-        }
-    }
-    else if (src < dest)
+    // Forward copies read every word before writing over it, so only a destination above the source needs care
+    if (pdest <= psrc || pdest >= psrc + n)
+        return memcpy(dest, src, n);
+
+    pdest += n;
+    psrc += n;
+    while (n >= 8)
     {
-        for (size_t i = n; i > 0; i--)
-        {
-            pdest[i - 1] = psrc[i - 1];
-        }
+        pdest -= 8;
+        psrc -= 8;
+        n -= 8;
+        *(string_word_t *)pdest = *(const string_word_t *)psrc;
     }
 
+    while (n--)
+        *--pdest = *--psrc;
+
     return dest;
 }
 
@@ -63,6 +137,22 @@ int memcmp(const void *s1, const void *s2, size_t n)
     const uint8_t *p1 = (const uint8_t *)s1;
     const uint8_t *p2 = (const uint8_t *)s2;
 
+    while (n >= 8)
+    {
+        uint64_t a = *(const string_word_t *)p1;
+        uint64_t b = *(const string_word_t *)p2;
+        if (a != b)
+        {
+            // Little endian, the lowest differing bit sits in the first differing byte
+            unsigned int byte = __builtin_ctzll(a ^ b) / 8;
+            return p1[byte] < p2[byte] ? -1 : 1;
+        }
+
+        p1 += 8;
+        p2 += 8;
+        n -= 8;
+    }
+
     for (size_t i = 0; i < n; i++)
     {
         if (p1[i] != p2[i])
@@ -76,12 +166,7 @@ int memcmp(const void *s1, const void *s2, size_t n)
 
 char *strdup(const char *s)
 {
-    size_t len = 0;
-
-    while (s[len] != '\0')
-    {
-        len++;
-    }
+    size_t len = strlen(s);
 
     char *copy = (char *)kmalloc(len + 1);
     if (!copy)
@@ -89,12 +174,7 @@ char *strdup(const char *s)
         return NULL;
     }
 
-    for (size_t i = 0; i < len; i++)
-    {
-        copy[i] = s[i];
-    }
-
-    copy[len] = '\0';
+    memcpy(copy, s, len + 1);
     return copy;
 }
 
@@ -143,14 +223,32 @@ char *strncpy(char *dest, const char *src, size_t n)
     return dest;
 }
 
+// Aligned word reads never cross into the next page, so scanning past the terminator is safe
 int strcmp(const char *str1, const char *str2)
 {
-    while (*str1 != '\0' && *str2 != '\0')
+    while (((uintptr_t)str1 & 7) != 0)
     {
-        if (*str1 != *str2)
-        {
+        if (*str1 != *str2 || *str1 == '\0')
             return (unsigned char)*str1 - (unsigned char)*str2;
+        str1++;
+        str2++;
+    }
+
+    if (((uintptr_t)str2 & 7) == 0)
+    {
+        for (;;)
+        {
+            uint64_t a = *(const string_word_t *)str1;
+            uint64_t b = *(const string_word_t *)str2;
+            if (a != b || STRING_HAS_ZERO(a))
+                break;
+            str1 += 8;
+            str2 += 8;
         }
+    }
+
+    while (*str1 != '\0' && *str1 == *str2)
+    {
         str1++;
         str2++;
     }
@@ -160,12 +258,20 @@ int strcmp(const char *str1, const char *str2)
 
 size_t strlen(const char *s)
 {
-    size_t length = 0;
-    while (s[length] != '\0')
+    const char *p = s;
+    while (((uintptr_t)p & 7) != 0)
     {
-        length++;
+        if (*p == '\0')
+            return p - s;
+        p++;
     }
-    return length;
+
+    const string_word_t *word = (const string_word_t *)p;
+    uint64_t zero;
+    while ((zero = STRING_HAS_ZERO(*word)) == 0)
+        word++;
+
+    return (const char *)word - s + __builtin_ctzll(zero) / 8;
 }
 
 long strtol(const char *nptr, char **endptr, int base)
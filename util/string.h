@@ -0,0 +1,30 @@
+/*
+ * Atlas Kernel - ShadowOS
+ *
+ * License: Apache 2.0
+ * Author: Kevin Alavik <kevin@alavik.se>
+ * Date: October 18, 2026
+ */
+
+#ifndef STRING_H
+#define STRING_H
+
+#include <stddef.h>
+
+void string_init(void);
+void string_bench(void);
+
+void *memcpy(void *dest, const void *src, size_t n);
+void *memset(void *s, int c, size_t n);
+void *memzero_nt(void *s, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+size_t strlen(const char *s);
+int strcmp(const char *str1, const char *str2);
+int strncmp(const char *s1, const char *s2, size_t n);
+char *strdup(const char *s);
+char *strstr(const char *haystack, const char *needle);
+char *strncpy(char *dest, const char *src, size_t n);
+long strtol(const char *nptr, char **endptr, int base);
+
+#endif // STRING_H
@@ -0,0 +1,147 @@
+/*
+ * Atlas Kernel - ShadowOS
+ *
+ * License: Apache 2.0
+ * Author: Kevin Alavik <kevin@alavik.se>
+ * Date: October 18, 2026
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <mm/kmalloc.h>
+#include <util/string.h>
+
+/* Defines */
+#define BENCH_MAX_SIZE 65536
+#define BENCH_BYTES (4ull << 20) // Moved per bucket and routine, iterations follow from the size
+
+extern void klog(const char *fmt, ...);
+
+/* Byte-at-a-time references, the routines util/string.c used to have */
+__attribute__((noinline)) static void *ref_memcpy(void *dest, const void *src, size_t n)
+{
+    uint8_t *pdest = (uint8_t *)dest;
+    const uint8_t *psrc = (const uint8_t *)src;
+    for (size_t i = 0; i < n; i++)
+        pdest[i] = psrc[i];
+    return dest;
+}
+
+__attribute__((noinline)) static void *ref_memset(void *s, int c, size_t n)
+{
+    uint8_t *p = (uint8_t *)s;
+    for (size_t i = 0; i < n; i++)
+        p[i] = (uint8_t)c;
+    return s;
+}
+
+__attribute__((noinline)) static int ref_memcmp(const void *s1, const void *s2, size_t n)
+{
+    const uint8_t *p1 = (const uint8_t *)s1;
+    const uint8_t *p2 = (const uint8_t *)s2;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (p1[i] != p2[i])
+            return p1[i] < p2[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+__attribute__((noinline)) static size_t ref_strlen(const char *s)
+{
+    size_t length = 0;
+    while (s[length] != '\0')
+        length++;
+    return length;
+}
+
+/* Timing */
+static inline uint64_t bench_tsc(void)
+{
+    uint32_t low, high;
+    __asm__ volatile("lfence; rdtsc" : "=a"(low), "=d"(high) : : "memory");
+    return ((uint64_t)high << 32) | low;
+}
+
+static volatile uint64_t bench_sink;
+
+enum bench_op
+{
+    BENCH_MEMCPY,
+    BENCH_MEMSET,
+    BENCH_MEMCMP,
+    BENCH_STRLEN
+};
+
+// Average cycles per call of one routine at one size
+static uint64_t bench_run(enum bench_op op, int fast, uint8_t *a, uint8_t *b, size_t size)
+{
+    size_t iterations = BENCH_BYTES / size;
+    uint64_t sink = 0;
+    uint64_t start = bench_tsc();
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        switch (op)
+        {
+        case BENCH_MEMCPY:
+            fast ? memcpy(a, b, size) : ref_memcpy(a, b, size);
+            break;
+        case BENCH_MEMSET:
+            fast ? memset(a, (int)i, size) : ref_memset(a, (int)i, size);
+            break;
+        case BENCH_MEMCMP:
+            sink += fast ? memcmp(a, b, size) : ref_memcmp(a, b, size);
+            break;
+        case BENCH_STRLEN:
+            sink += fast ? strlen((const char *)b) : ref_strlen((const char *)b);
+            break;
+        }
+    }
+
+    uint64_t cycles = bench_tsc() - start;
+    bench_sink = sink;
+    return cycles / iterations;
+}
+
+/* Main logic */
+void string_bench(void)
+{
+    static const size_t sizes[] = {16, 64, 256, 1024, 4096, BENCH_MAX_SIZE};
+    static const char *names[] = {"memcpy", "memset", "memcmp", "strlen"};
+
+    uint8_t *a = (uint8_t *)kmalloc(BENCH_MAX_SIZE + 1);
+    uint8_t *b = (uint8_t *)kmalloc(BENCH_MAX_SIZE + 1);
+    if (!a || !b)
+    {
+        klog("string bench: failed to allocate buffers");
+        kfree(a);
+        kfree(b);
+        return;
+    }
+
+    klog("string bench: cycles per call, byte loop -> current");
+    for (int op = BENCH_MEMCPY; op <= BENCH_STRLEN; op++)
+    {
+        for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+        {
+            size_t size = sizes[i];
+
+            // Equal buffers so memcmp walks the whole size, b doubles as a string of that length
+            memset(a, 'a', BENCH_MAX_SIZE + 1);
+            memset(b, 'a', BENCH_MAX_SIZE + 1);
+            b[size] = '\0';
+            a[size] = '\0';
+
+            uint64_t slow = bench_run((enum bench_op)op, 0, a, b, size);
+            uint64_t fast = bench_run((enum bench_op)op, 1, a, b, size);
+            klog("  %s %6llu bytes: %8llu -> %8llu (%llu.%llux)", names[op], (unsigned long long)size,
+                 (unsigned long long)slow, (unsigned long long)fast,
+                 (unsigned long long)(fast ? slow / fast : 0),
+                 (unsigned long long)(fast ? (slow * 10 / fast) % 10 : 0));
+        }
+    }
+
+    kfree(a);
+    kfree(b);
+}